@@ -6,7 +6,11 @@
 
 #pragma once
 
-#include "gcem.hpp"
+#include "math.hpp"
+#include "util.hpp"
+
+#include <limits>
+#include <optional>
 
 namespace Thermistor::Circuit {
     struct None {
@@ -19,16 +23,38 @@ namespace Thermistor::Circuit {
         double vref;
         double impedance;
 
+      private:
+        // returns the reason the parameters are invalid, or nullptr
+        static constexpr char const* check(double vref,
+                                           double impedance) noexcept {
+            if (vref <= 0.0)
+                return "vref must be greater than zero";
+
+            if (impedance <= 0.0)
+                return "impedance must be greater than zero";
+
+            return nullptr;
+        }
+
+      public:
         constexpr Adc(double vref, double impedance =
                                        std::numeric_limits<double>::infinity())
             : vref(vref)
             , impedance(impedance) {
 
-            if (vref <= 0.0)
-                throw std::runtime_error("vref must be greater than zero");
+            if (auto what = check(vref, impedance))
+                error<std::runtime_error>(what);
+        }
 
-            if (impedance <= 0.0)
-                throw std::runtime_error("impedance must be greater than zero");
+        // non-throwing construction, empty if the parameters are invalid
+        static constexpr std::optional<Adc>
+        try_make(double vref,
+                 double impedance =
+                     std::numeric_limits<double>::infinity()) noexcept {
+            if (check(vref, impedance))
+                return std::nullopt;
+
+            return Adc{vref, impedance};
         }
 
         constexpr double convert(double voltage) const {
@@ -38,7 +64,7 @@ namespace Thermistor::Circuit {
             else if (ratio < 0.0)
                 ratio = 0.0;
 
-            return gcem::floor(ratio * ((1 << resolution) - 1));
+            return Math::floor(ratio * ((1 << resolution) - 1));
         }
     };
 
@@ -62,5 +88,13 @@ namespace Thermistor::Circuit {
 
             return adc.convert((supply * r2) / (r1 + r2));
         }
+
+        template <typename InputIt, typename OutputIt>
+        constexpr OutputIt transform(InputIt first, InputIt last,
+                                     OutputIt out) const {
+            return Thermistor::transform(
+                first, last, out,
+                [this](double res) { return transform(res); });
+        }
     };
 } // namespace Thermistor::Circuit
@@ -0,0 +1,43 @@
+// Math functions usable at compile time and at runtime
+//
+// Author: Matthew Knight
+// File Name: math.hpp
+// Date: 2026-10-19
+
+#pragma once
+
+#include "util.hpp"
+
+#include "gcem.hpp"
+
+#include <cmath>
+
+// gcem is used during constant evaluation so that generated tables do not
+// change, the standard library at runtime where it is faster and can be
+// vectorised
+namespace Thermistor::Math {
+    constexpr double exp(double x) {
+        return is_constant_evaluated() ? gcem::exp(x) : std::exp(x);
+    }
+
+    constexpr double log(double x) {
+        return is_constant_evaluated() ? gcem::log(x) : std::log(x);
+    }
+
+    constexpr double sqrt(double x) {
+        return is_constant_evaluated() ? gcem::sqrt(x) : std::sqrt(x);
+    }
+
+    constexpr double pow(double x, double y) {
+        return is_constant_evaluated() ? gcem::pow(x, y) : std::pow(x, y);
+    }
+
+    constexpr double cbrt(double x) {
+        return is_constant_evaluated() ? gcem::pow(x, 1.0 / 3.0)
+                                       : std::cbrt(x);
+    }
+
+    constexpr double floor(double x) {
+        return is_constant_evaluated() ? gcem::floor(x) : std::floor(x);
+    }
+} // namespace Thermistor::Math
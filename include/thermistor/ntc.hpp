@@ -14,7 +14,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <optional>
 #include <tuple>
+#include <type_traits>
 
 namespace Thermistor {
     template <auto minimum, auto maximum>
@@ -25,21 +28,153 @@ namespace Thermistor {
         static constexpr auto max = maximum;
     };
 
+    // tag selecting the Ntc constructor that adopts a pre-baked table
+    struct FromTable {
+        explicit FromTable() = default;
+    };
+
+    inline constexpr FromTable from_table{};
+
+    template <auto bits, typename View>
+    class NtcIndex;
+
+    // Non-owning, pointer sized view of an Ntc table. Views of the same lut
+    // share its single table; see canonical_lut for one table per
+    // configuration. A view must not outlive its lut, so views cannot be
+    // taken of temporaries.
     template <typename TempRange, auto datapoints, typename Temp,
               typename TableValue = std::uint32_t,
               typename = std::enable_if_t<std::is_signed_v<Temp>>>
-    class Ntc {
+    class NtcView {
+      public:
         using Table = std::array<TableValue, datapoints>;
-        Table table{};
+        using TempType = Temp;
+
+      private:
+        template <auto, typename>
+        friend class NtcIndex;
+
+        Table const* table;
+
+        // interpolates res given a subrange of the reversed table that is
+        // known to contain its lower bound
+        template <typename ReverseIt>
+        std::pair<Temp, bool> interpolate_in(TableValue const& res,
+                                             ReverseIt first,
+                                             ReverseIt last) const {
+            auto it = std::lower_bound(first, last, res);
+
+            // saturate the value if out of bounds
+            if (it == table->rbegin()) {
+                // handle case where reading is on edge of max temp
+                Temp temp = iterator_to_temp(table->rbegin());
+                if (res == *table->rbegin())
+                    return std::make_pair(temp, false);
+                else
+                    return std::make_pair(temp, true);
+            } else if (it == table->rend()) {
+                return std::make_pair(
+                    iterator_to_temp(std::prev(table->rend())), true);
+            } else {
+                // interpolate
+                Temp x1 = iterator_to_temp(it);
+                Temp x2 = iterator_to_temp(std::prev(it));
+                TableValue y1 = *it;
+                TableValue y2 = *std::prev(it);
+
+                return std::make_pair(x1 + ((y1 - res) * (x2 - x1) / (y1 - y2)),
+                                      false);
+            }
+        }
 
       public:
         static constexpr auto delta =
             static_cast<double>(TempRange::max - TempRange::min) /
             (datapoints - 1);
 
+        constexpr explicit NtcView(Table const& table)
+            : table(&table) {}
+
+        NtcView(Table&&) = delete;
+
+        template <typename IndexType>
+        constexpr Temp index_to_temp(IndexType i) const {
+            return static_cast<Temp>(i) * delta + TempRange::min;
+        }
+
+        template <typename Iterator>
+        constexpr Temp iterator_to_temp(Iterator const& it) const {
+            return index_to_temp(std::distance(it, table->rend()) - 1);
+        }
+
+        constexpr Table const& data() const noexcept { return *table; }
+
+        constexpr auto begin() const noexcept { return table->cbegin(); }
+
+        constexpr auto end() const noexcept { return table->cend(); }
+
+        constexpr auto size() const noexcept { return table->size(); }
+
+        constexpr auto operator[](typename Table::size_type pos) const {
+            return (*table)[pos];
+        }
+
+        // outputs interpolated temperature and whether it is a saturated
+        // value
+        std::pair<Temp, bool> interpolate(TableValue const& res) const {
+            return interpolate_in(res, table->rbegin(), table->rend());
+        }
+
+        // interpolates a batch of readings, writing the result for each one to
+        // out. The table is never modified after construction, so disjoint
+        // batches may be converted concurrently from separate threads.
+        template <typename InputIt, typename OutputIt>
+        OutputIt interpolate(InputIt first, InputIt last, OutputIt out) const {
+            return Thermistor::transform(
+                first, last, out,
+                [this](TableValue const& res) { return interpolate(res); });
+        }
+    };
+
+    template <typename TempRange, auto datapoints, typename Temp,
+              typename TableValue = std::uint32_t,
+              typename = std::enable_if_t<std::is_signed_v<Temp>>>
+    class Ntc {
+      public:
+        using Table = std::array<TableValue, datapoints>;
+        using View = NtcView<TempRange, datapoints, Temp, TableValue>;
+
+      private:
+        struct Unvalidated {};
+
+        Table table{};
+
+        // returns the reason the table is invalid, or nullptr
+        static constexpr char const* check(Table const& table) noexcept {
+            if (!descending(std::begin(table), std::end(table))) {
+                if (over_sampled(std::begin(table), std::end(table)))
+                    return "the thermistor transfer function is over sampled "
+                           "and not able to distinguish between some "
+                           "temperatures (decrease number of datapoints)";
+                return "table values must be in descending order";
+            }
+
+            return nullptr;
+        }
+
+        constexpr void validate() const {
+            if (auto what = check(table))
+                error<std::logic_error>(what);
+        }
+
+        // lowest temperature of the table in kelvin, must be above zero for
+        // the Steinhart equation
+        static constexpr double lowest = TempRange::min + kelvin;
+
+        // generates the table without checking its order
         template <typename Circuit>
-        constexpr Ntc(Steinhart const& equation,
-                      Circuit const& circuit = Thermistor::Circuit::None{}) {
+        constexpr Ntc(Unvalidated, Steinhart const& equation,
+                      Circuit const& circuit) {
             for (auto i = 0; i < datapoints; i++) {
                 double res = equation.calculate_res(
                     static_cast<double>(i * delta) + TempRange::min + kelvin);
@@ -51,31 +186,75 @@ namespace Thermistor {
                 else
                     table[i] = value;
             }
+        }
 
-            if (!descending(std::begin(table), std::end(table))) {
-                if (over_sampled(std::begin(table), std::end(table)))
-                    throw std::logic_error(
-                        "the thermistor transfer function is over sampled "
-                        "and not able to distinguish between some "
-                        "temperatures (decrease number of datapoints)");
-                throw std::logic_error(
-                    "table values must be in descending order");
-            }
+      public:
+        static constexpr auto delta = View::delta;
+
+        template <typename Circuit>
+        constexpr Ntc(Steinhart const& equation,
+                      Circuit const& circuit = Thermistor::Circuit::None{})
+            : Ntc(Unvalidated{}, equation, circuit) {
+            validate();
         }
 
         constexpr Ntc(Steinhart const& equation)
             : Ntc(equation, Circuit::None{}) {}
 
+        // non-throwing generation of a table, empty if the range is below
+        // absolute zero or the table is not strictly descending
+        template <typename Circuit>
+        static constexpr std::optional<Ntc>
+        try_make(Steinhart const& equation, Circuit const& circuit) noexcept {
+            if (lowest <= 0.0)
+                return std::nullopt;
+
+            Ntc lut{Unvalidated{}, equation, circuit};
+            if (check(lut.table))
+                return std::nullopt;
+
+            return lut;
+        }
+
+        static constexpr std::optional<Ntc>
+        try_make(Steinhart const& equation) noexcept {
+            return try_make(equation, Circuit::None{});
+        }
+
+        // adopt a table generated ahead of time, e.g. dumped from data() of
+        // an equivalent lut by an offline tool, so that the Steinhart
+        // equation does not have to be evaluated at compile time
+        constexpr Ntc(FromTable, Table const& values)
+            : table(values) {
+            validate();
+        }
+
+        // non-throwing adoption of a table, empty if the table is invalid
+        static constexpr std::optional<Ntc>
+        try_from_table(Table const& values) noexcept {
+            if (check(values))
+                return std::nullopt;
+
+            return Ntc{from_table, values};
+        }
+
+        // the view must not outlive this lut
+        constexpr View view() const& noexcept { return View{table}; }
+
+        View view() const&& = delete;
+
         template <typename IndexType>
         constexpr Temp index_to_temp(IndexType i) const {
-            return static_cast<Temp>(i) * delta + TempRange::min;
+            return view().index_to_temp(i);
         }
 
         template <typename Iterator>
         constexpr Temp iterator_to_temp(Iterator const& it) const {
-            return index_to_temp(std::distance(it, table.rend()) - 1);
+            return view().iterator_to_temp(it);
         }
 
+        constexpr Table const& data() const noexcept { return table; }
+
         constexpr auto begin() const noexcept { return table.cbegin(); }
 
         constexpr auto end() const noexcept { return table.cend(); }
@@ -89,29 +268,91 @@ namespace Thermistor {
         // outputs interpolated temperature and whether it is a saturated
         // value
         std::pair<Temp, bool> interpolate(TableValue const& res) const {
-            auto it = std::lower_bound(table.rbegin(), table.rend(), res);
+            return view().interpolate(res);
+        }
 
-            // saturate the value if out of bounds
-            if (it == table.rbegin()) {
-                // handle case where reading is on edge of max temp
-                Temp temp = iterator_to_temp(table.rbegin());
-                if (res == *table.rbegin())
-                    return std::make_pair(temp, false);
-                else
-                    return std::make_pair(temp, true);
-            } else if (it == table.rend()) {
-                return std::make_pair(iterator_to_temp(std::prev(table.rend())),
-                                      true);
-            } else {
-                // interpolate
-                Temp x1 = iterator_to_temp(it);
-                Temp x2 = iterator_to_temp(std::prev(it));
-                TableValue y1 = *it;
-                TableValue y2 = *std::prev(it);
+        template <typename InputIt, typename OutputIt>
+        OutputIt interpolate(InputIt first, InputIt last, OutputIt out) const {
+            return view().interpolate(first, last, out);
+        }
+    };
 
-                return std::make_pair(x1 + ((y1 - res) * (x2 - x1) / (y1 - y2)),
-                                      false);
+    // The single lut shared by every user of a configuration. Config is a
+    // type providing static constexpr `equation` (a Steinhart) and `circuit`
+    // (e.g. Circuit::None{}) members, so identical configurations share one
+    // table in the program and can pass around canonical_lut<...>.view().
+    template <typename Lut, typename Config>
+    inline constexpr Lut canonical_lut{Config::equation, Config::circuit};
+
+    // Two level lookup for large integral tables, e.g. for high resolution
+    // adcs. The raw value's offset from the smallest table entry is bucketed
+    // on its high bits, and each bucket records the segment of the table it
+    // covers so that interpolate only has to search that segment. Build it
+    // at compile time from the view of a lut with static storage.
+    template <auto bits, typename View>
+    class NtcIndex {
+        using Table = typename View::Table;
+        using TableValue = typename Table::value_type;
+        using Temp = typename View::TempType;
+        using Offset = std::conditional_t<(std::tuple_size_v<Table> <= 0xffff),
+                                          std::uint16_t, std::uint32_t>;
+
+        static_assert(std::is_integral_v<TableValue>,
+                      "index requires an integral table");
+        static_assert(bits > 0 && bits < 16, "bits must be in [1, 15]");
+
+        static constexpr std::size_t buckets = std::size_t{1} << bits;
+
+        View lut;
+        TableValue min{};
+        TableValue max{};
+        unsigned shift{};
+        std::array<Offset, buckets + 1> starts{};
+
+        constexpr std::size_t key(TableValue const& res) const {
+            return static_cast<std::size_t>(res - min) >> shift;
+        }
+
+      public:
+        constexpr NtcIndex(View const& lut)
+            : lut(lut)
+            , min(*lut.data().rbegin())
+            , max(*lut.data().begin()) {
+            // smallest shift that fits the table's span into the buckets
+            while ((static_cast<std::size_t>(max - min) >> shift) >= buckets)
+                shift++;
+
+            // starts[k] is the position in the reversed table of the first
+            // value whose key is at least k
+            std::size_t pos = 0;
+            for (std::size_t k = 0; k <= buckets; k++) {
+                while (pos < lut.size() &&
+                       key(lut[lut.size() - 1 - pos]) < k)
+                    pos++;
+
+                starts[k] = pos;
             }
         }
+
+        // same result as the lut's interpolate
+        std::pair<Temp, bool> interpolate(TableValue const& res) const {
+            auto first = lut.data().rbegin();
+            if (res <= min)
+                return lut.interpolate_in(res, first, first);
+            else if (res > max)
+                return lut.interpolate_in(res, lut.data().rend(),
+                                          lut.data().rend());
+
+            auto k = key(res);
+            return lut.interpolate_in(res, first + starts[k],
+                                      first + starts[k + 1]);
+        }
+
+        template <typename InputIt, typename OutputIt>
+        OutputIt interpolate(InputIt first, InputIt last, OutputIt out) const {
+            return Thermistor::transform(
+                first, last, out,
+                [this](TableValue const& res) { return interpolate(res); });
+        }
     };
 } // namespace Thermistor
@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include "math.hpp"
 #include "util.hpp"
 
 #include "gcem.hpp"
 
 #include <algorithm>
 #include <array>
+#include <optional>
 #include <tuple>
 
 namespace Thermistor {
@@ -39,6 +41,23 @@ namespace Thermistor {
         double b{};
         double c{};
 
+        constexpr double temp_unchecked(double res) const noexcept {
+            double l = Math::log(res);
+            return 1 / (a + (b * l) + (c * (l * l * l)));
+        }
+
+        constexpr double res_unchecked(double temp) const noexcept {
+            // if c was precisely set to zero -- single beta case
+            if (c == 0.0) {
+                return Math::exp(((1.0 / temp) - a) / b);
+            } else {
+                double y = (1.0 / (2.0 * c)) * (a - (1.0 / temp));
+                double x = Math::sqrt(Math::pow(b / (3.0 * c), 3.0) + (y * y));
+
+                return Math::exp(Math::cbrt(x - y) - Math::cbrt(x + y));
+            }
+        }
+
       public:
         constexpr Steinhart(double a, double b, double c)
             : a(a)
@@ -82,31 +101,94 @@ namespace Thermistor {
             a = y0 - l0 * (b + (c * (l0 * l0)));
         }
 
+        // calculates absolute temperature, empty if res is out of domain
+        constexpr std::optional<double> try_calculate_temp(double res) const
+            noexcept {
+            if (res <= 0.0)
+                return std::nullopt;
+
+            return temp_unchecked(res);
+        }
+
+        // calculate resistance from absolute temperature, empty if temp is out
+        // of domain
+        constexpr std::optional<double> try_calculate_res(double temp) const
+            noexcept {
+            if (temp <= 0.0)
+                return std::nullopt;
+
+            return res_unchecked(temp);
+        }
+
         // calculates absolute temperature
         constexpr double calculate_temp(double res) const {
             if (res <= 0.0)
-                throw std::runtime_error(
+                error<std::runtime_error>(
                     "cannot have negative or zero resistance");
-            return 1 / (a + (b * gcem::log(res)) +
-                        (c * gcem::pow(gcem::log(res), 3.0)));
+
+            return temp_unchecked(res);
+        }
+
+        // calculates absolute temperatures for a range of resistances, empty
+        // and nothing written if any resistance is out of domain. The whole
+        // range is checked before any conversion so that the conversion loop
+        // itself is branch free
+        template <typename ForwardIt, typename OutputIt>
+        constexpr std::optional<OutputIt>
+        try_calculate_temp(ForwardIt first, ForwardIt last, OutputIt out) const
+            noexcept {
+            if (Thermistor::find_if(first, last, [](double res) {
+                    return res <= 0.0;
+                }) != last)
+                return std::nullopt;
+
+            return Thermistor::transform(
+                first, last, out,
+                [this](double res) { return temp_unchecked(res); });
+        }
+
+        template <typename ForwardIt, typename OutputIt>
+        constexpr OutputIt calculate_temp(ForwardIt first, ForwardIt last,
+                                          OutputIt out) const {
+            if (auto end = try_calculate_temp(first, last, out))
+                return *end;
+
+            error<std::runtime_error>("cannot have negative or zero resistance");
         }
 
         // calculate resistance from absolute temperature
         constexpr double calculate_res(double temp) const {
             if (temp <= 0.0)
-                throw std::runtime_error(
+                error<std::runtime_error>(
                     "cannot have negative or zero absolute temperature");
 
-            // if c was precisely set to zero -- single beta case
-            if (c == 0.0) {
-                return gcem::exp(((1.0 / temp) - a) / b);
-            } else {
-                double y = (1.0 / (2.0 * c)) * (a - (1.0 / temp));
-                double x = gcem::sqrt(gcem::pow(b / (3.0 * c), 3.0) + (y * y));
+            return res_unchecked(temp);
+        }
 
-                return gcem::exp(gcem::pow(x - y, 1.0 / 3.0) -
-                                 gcem::pow(x + y, 1.0 / 3.0));
-            }
+        // calculates resistances for a range of absolute temperatures, empty
+        // and nothing written if any temperature is out of domain
+        template <typename ForwardIt, typename OutputIt>
+        constexpr std::optional<OutputIt>
+        try_calculate_res(ForwardIt first, ForwardIt last, OutputIt out) const
+            noexcept {
+            if (Thermistor::find_if(first, last, [](double temp) {
+                    return temp <= 0.0;
+                }) != last)
+                return std::nullopt;
+
+            return Thermistor::transform(
+                first, last, out,
+                [this](double temp) { return res_unchecked(temp); });
+        }
+
+        template <typename ForwardIt, typename OutputIt>
+        constexpr OutputIt calculate_res(ForwardIt first, ForwardIt last,
+                                         OutputIt out) const {
+            if (auto end = try_calculate_res(first, last, out))
+                return *end;
+
+            error<std::runtime_error>(
+                "cannot have negative or zero absolute temperature");
         }
     };
 } // namespace Thermistor
@@ -6,9 +6,47 @@
 
 #pragma once
 
+#include <cstdlib>
 #include <iterator>
+#include <stdexcept>
+
+// defined when the library is built with exception support
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define THERMISTOR_EXCEPTIONS
+#endif
+
+// defined when the compiler can tell constant evaluation from runtime
+#if defined(_MSC_VER) && _MSC_VER >= 1925
+#define THERMISTOR_IS_CONSTANT_EVALUATED
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define THERMISTOR_IS_CONSTANT_EVALUATED
+#endif
+#endif
 
 namespace Thermistor {
+	// c++17 stand in for std::is_constant_evaluated. Without compiler support
+	// everything is treated as constant evaluation
+	constexpr bool is_constant_evaluated() noexcept {
+#ifdef THERMISTOR_IS_CONSTANT_EVALUATED
+		return __builtin_is_constant_evaluated();
+#else
+		return true;
+#endif
+	}
+
+	// reports an error. Reaching this during constant evaluation is a compile
+	// error; at runtime it throws, or aborts when built with -fno-exceptions
+	template <typename Exception>
+	[[noreturn]] inline void error(char const* what) {
+#ifdef THERMISTOR_EXCEPTIONS
+		throw Exception(what);
+#else
+		static_cast<void>(what);
+		std::abort();
+#endif
+	}
+
 	// constexpr range checker. predicate is used to compare every element and
 	// its predesesor
 	template <typename Iterator, typename Predicate>
@@ -31,6 +69,28 @@ namespace Thermistor {
 		return false;
 	}
 
+	// constexpr replacement for std::transform, which is not constexpr until
+	// c++20
+	template <typename InputIt, typename OutputIt, typename UnaryOp>
+	constexpr OutputIt transform(InputIt first, InputIt last, OutputIt out,
+	                             UnaryOp op) {
+		for (; first != last; ++first, ++out)
+			*out = op(*first);
+
+		return out;
+	}
+
+	// constexpr replacement for std::find_if, which is not constexpr until
+	// c++20
+	template <typename Iterator, typename Predicate>
+	constexpr Iterator find_if(Iterator first, Iterator last, Predicate p) {
+		for (; first != last; ++first)
+			if (p(*first))
+				return first;
+
+		return last;
+	}
+
 	// checks if range is in ascending order
 	template <typename Iterator>
 	constexpr bool ascending(Iterator first, Iterator last) {
@@ -20,4 +20,5 @@ class ThermistorTestConan(ConanFile):
         if not tools.cross_building(self.settings):
             os.chdir("bin")
             self.run(".%sThermistorTest" % os.sep)
+            self.run(".%sThermistorTestNoExceptions" % os.sep)
 
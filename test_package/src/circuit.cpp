@@ -15,6 +15,7 @@
 #include <limits>
 #include <random>
 #include <utility>
+#include <vector>
 
 using TempRange = Thermistor::Range<-10, 50>;
 
@@ -76,6 +77,13 @@ TEST(CircuitTests, Adc) {
 
     create_adc_test(adc)();
     create_adc_test(adc_imp)();
+
+    using Adc = Thermistor::Circuit::Adc<12>;
+    static_assert(Adc::try_make(vref, impedance));
+    EXPECT_EQ(Adc::try_make(vref)->vref, vref);
+    EXPECT_FALSE(Adc::try_make(0.0));
+    EXPECT_FALSE(Adc::try_make(-vref));
+    EXPECT_FALSE(Adc::try_make(vref, 0.0));
 }
 
 double bridge_calculate(double supply, double r1, double r2,
@@ -111,6 +119,16 @@ TEST(CircuitTests, HalfBridge) {
                          bridge.transform(r2));
     }
 
+    // batch transform matches transforming each value individually
+    std::vector<double> resistances(1000);
+    std::generate(resistances.begin(), resistances.end(),
+                  [&] { return dist(gen); });
+
+    std::vector<double> codes(resistances.size());
+    bridge.transform(resistances.begin(), resistances.end(), codes.begin());
+    for (auto i = 0; i < codes.size(); i++)
+        EXPECT_DOUBLE_EQ(bridge.transform(resistances[i]), codes[i]);
+
     // test that it constexpr compiles with Ntc
     constexpr Thermistor::Ntc<Thermistor::Range<-10, 110>, 121, double,
                               std::uint16_t>
@@ -17,11 +17,13 @@
 #include <limits>
 #include <random>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 template <typename LutType, typename Data>
 auto mean_squared_error(LutType const& lut, Data const& table) {
     if (lut.size() != table.size())
-        throw std::runtime_error("sizes do not match");
+        Thermistor::error<std::runtime_error>("sizes do not match");
 
     double acc = 0.0;
     for (auto i = 0; i < table.size(); i++) {
@@ -42,6 +44,70 @@ TEST(NtcTests, SteinhartTest) {
     }
 }
 
+TEST(NtcTests, SteinhartBatchTest) {
+    std::array<double, Typical::data.size()> temps{};
+    std::array<double, Typical::data.size()> resistances{};
+    std::transform(Typical::data.begin(), Typical::data.end(), temps.begin(),
+                   [](auto const& datapoint) { return datapoint.first; });
+
+    Typical::equation.calculate_res(temps.begin(), temps.end(),
+                                    resistances.begin());
+    for (auto i = 0; i < resistances.size(); i++)
+        EXPECT_DOUBLE_EQ(Typical::equation.calculate_res(temps[i]),
+                         resistances[i]);
+
+    std::array<double, Typical::data.size()> round_trip{};
+    Typical::equation.calculate_temp(resistances.begin(), resistances.end(),
+                                     round_trip.begin());
+    for (auto i = 0; i < round_trip.size(); i++)
+        EXPECT_FLOAT_EQ(temps[i], round_trip[i]);
+}
+
+TEST(NtcTests, SteinhartCheckedTest) {
+    for (auto& datapoint : Typical::data) {
+        EXPECT_EQ(Typical::equation.try_calculate_res(datapoint.first),
+                  Typical::equation.calculate_res(datapoint.first));
+        EXPECT_EQ(Typical::equation.try_calculate_temp(datapoint.second),
+                  Typical::equation.calculate_temp(datapoint.second));
+    }
+
+    EXPECT_FALSE(Typical::equation.try_calculate_res(0.0));
+    EXPECT_FALSE(Typical::equation.try_calculate_res(-1.0));
+    EXPECT_FALSE(Typical::equation.try_calculate_temp(0.0));
+    EXPECT_FALSE(Typical::equation.try_calculate_temp(-1.0));
+
+#ifdef THERMISTOR_EXCEPTIONS
+    EXPECT_THROW(Typical::equation.calculate_res(0.0), std::runtime_error);
+    EXPECT_THROW(Typical::equation.calculate_temp(0.0), std::runtime_error);
+#endif
+}
+
+TEST(NtcTests, SteinhartBatchCheckedTest) {
+    std::array<double, 3> temps{kelvin(0.0), 0.0, kelvin(10.0)};
+    std::array<double, 3> resistances{};
+
+    // nothing is converted when any input is out of domain
+    EXPECT_FALSE(Typical::equation.try_calculate_res(
+        temps.begin(), temps.end(), resistances.begin()));
+    EXPECT_FALSE(Typical::equation.try_calculate_temp(
+        temps.begin(), temps.end(), resistances.begin()));
+    for (auto res : resistances)
+        EXPECT_EQ(0.0, res);
+
+    temps[1] = kelvin(5.0);
+    auto end = Typical::equation.try_calculate_res(temps.begin(), temps.end(),
+                                                   resistances.begin());
+    ASSERT_TRUE(end);
+    EXPECT_EQ(resistances.end(), *end);
+
+#ifdef THERMISTOR_EXCEPTIONS
+    temps[1] = -1.0;
+    EXPECT_THROW(Typical::equation.calculate_res(temps.begin(), temps.end(),
+                                                 resistances.begin()),
+                 std::runtime_error);
+#endif
+}
+
 TEST(NtcTests, SteinhartLookupTest) {
     using TempRange = Thermistor::Range<-10, 50>;
     constexpr Thermistor::Ntc<TempRange, Typical::data.size(), double, double>
@@ -166,3 +232,156 @@ TEST(NtcTests, SaturationTest) {
     EXPECT_DOUBLE_EQ(max_temp_outside, static_cast<double>(TempRange::min));
     EXPECT_DOUBLE_EQ(min_temp_outside, static_cast<double>(TempRange::max));
 }
+
+TEST(NtcTests, BatchInterpolationTest) {
+    using TempRange = Thermistor::Range<-10, 10>;
+    constexpr Thermistor::Ntc<TempRange, 21, double> lut{Typical::equation};
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<std::uint32_t> dist(lut[20] - 10,
+                                                      lut[0] + 10);
+
+    std::vector<std::uint32_t> readings(1000);
+    std::generate(readings.begin(), readings.end(), [&] { return dist(gen); });
+
+    std::vector<std::pair<double, bool>> results(readings.size());
+    auto end = lut.interpolate(readings.begin(), readings.end(),
+                               results.begin());
+
+    EXPECT_EQ(end, results.end());
+    for (auto i = 0; i < readings.size(); i++)
+        EXPECT_EQ(lut.interpolate(readings[i]), results[i]);
+}
+
+TEST(NtcTests, CheckedGenerationTest) {
+    using Lut = Thermistor::Ntc<Thermistor::Range<-10, 50>, 61, double>;
+    constexpr Lut lut{Typical::equation};
+
+    auto generated = Lut::try_make(Typical::equation);
+    ASSERT_TRUE(generated);
+    EXPECT_EQ(lut.data(), generated->data());
+
+    // range below absolute zero
+    using ColdLut = Thermistor::Ntc<Thermistor::Range<-300, 0>, 31, double>;
+    EXPECT_FALSE(ColdLut::try_make(Typical::equation));
+
+    // an 8 bit adc cannot distinguish between 241 temperatures
+    using CoarseLut = Thermistor::Ntc<Thermistor::Range<-10, 50>, 241, double,
+                                      std::uint8_t>;
+    Thermistor::Circuit::HalfBridge bridge{Thermistor::Circuit::Adc<8>{3.3},
+                                           3.3, 3000.0};
+    EXPECT_FALSE(CoarseLut::try_make(Typical::equation, bridge));
+}
+
+TEST(NtcTests, PrebakedTableTest) {
+    using TempRange = Thermistor::Range<-10, 50>;
+    using Lut = Thermistor::Ntc<TempRange, 61, double, std::uint16_t>;
+    constexpr Lut generated{Typical::equation};
+    constexpr Lut prebaked{Thermistor::from_table, generated.data()};
+
+    EXPECT_EQ(generated.data(), prebaked.data());
+    for (auto i = 0; i < 100; i++) {
+        std::uint16_t res = generated[60] + (i * 100);
+        EXPECT_EQ(generated.interpolate(res), prebaked.interpolate(res));
+    }
+
+    // a braced list of coefficients still selects the Steinhart constructor
+    constexpr Lut coefficients{{1.4e-3, 2.37e-4, 9.9e-8}};
+    EXPECT_EQ(coefficients.data(), generated.data());
+    static_assert(!std::is_convertible_v<Lut::Table, Lut>);
+
+    // tables that are not strictly descending are rejected
+    Lut::Table flat{};
+    EXPECT_FALSE(Lut::try_from_table(flat));
+    EXPECT_EQ(Lut::try_from_table(generated.data())->data(), generated.data());
+#ifdef THERMISTOR_EXCEPTIONS
+    EXPECT_THROW((Lut{Thermistor::from_table, flat}), std::logic_error);
+#endif
+}
+
+namespace {
+    using SharedLut = Thermistor::Ntc<Thermistor::Range<-10, 50>, 61, double,
+                                      std::uint16_t>;
+    constexpr SharedLut shared_lut{Typical::equation};
+
+    struct SharedConfig {
+        static constexpr Thermistor::Steinhart equation = Typical::equation;
+        static constexpr Thermistor::Circuit::None circuit{};
+    };
+
+    template <typename Lut, typename = void>
+    struct can_view_temporary : std::false_type {};
+
+    template <typename Lut>
+    struct can_view_temporary<Lut,
+                              std::void_t<decltype(std::declval<Lut>().view())>>
+        : std::true_type {};
+} // namespace
+
+TEST(NtcTests, ViewTest) {
+    constexpr SharedLut::View view = shared_lut.view();
+    constexpr SharedLut::View other = shared_lut.view();
+
+    static_assert(sizeof(view) == sizeof(void*));
+    EXPECT_EQ(&view.data(), &shared_lut.data());
+    EXPECT_EQ(&view.data(), &other.data());
+    EXPECT_EQ(view.size(), shared_lut.size());
+
+    for (auto i = 0; i < 100; i++) {
+        std::uint16_t res = shared_lut[60] + (i * 100);
+        EXPECT_EQ(shared_lut.interpolate(res), view.interpolate(res));
+    }
+}
+
+TEST(NtcTests, ViewLifetimeTest) {
+    // views cannot be taken of temporary luts or tables, where they would
+    // dangle
+    static_assert(!can_view_temporary<SharedLut>::value);
+    static_assert(can_view_temporary<SharedLut const&>::value);
+    static_assert(
+        !std::is_constructible_v<SharedLut::View, SharedLut::Table&&>);
+    static_assert(
+        !std::is_convertible_v<SharedLut::Table const&, SharedLut::View>);
+}
+
+TEST(NtcTests, CanonicalLutTest) {
+    using Thermistor::canonical_lut;
+
+    constexpr auto view = canonical_lut<SharedLut, SharedConfig>.view();
+    constexpr auto other = canonical_lut<SharedLut, SharedConfig>.view();
+
+    EXPECT_EQ(&view.data(), &other.data());
+    EXPECT_EQ(view.data(), shared_lut.data());
+}
+
+namespace {
+    constexpr Thermistor::Circuit::HalfBridge sigma_delta{
+        Thermistor::Circuit::Adc<24>{3.3}, 3.3, 3000.0};
+    using HighResLut =
+        Thermistor::Ntc<Thermistor::Range<-40, 125>, 331, double>;
+    constexpr HighResLut high_res_lut{Typical::equation, sigma_delta};
+} // namespace
+
+TEST(NtcTests, IndexTest) {
+    constexpr Thermistor::NtcIndex<6, HighResLut::View> index{
+        high_res_lut.view()};
+
+    std::uint32_t min = high_res_lut[high_res_lut.size() - 1];
+    std::uint32_t max = high_res_lut[0];
+
+    // table entries and the saturated region just past each end
+    for (auto value : high_res_lut)
+        EXPECT_EQ(high_res_lut.interpolate(value), index.interpolate(value));
+
+    for (std::uint32_t i = 0; i < 10; i++) {
+        EXPECT_EQ(high_res_lut.interpolate(min - i), index.interpolate(min - i));
+        EXPECT_EQ(high_res_lut.interpolate(max + i), index.interpolate(max + i));
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<std::uint32_t> dist(min, max);
+    for (auto i = 0; i < 10000; i++) {
+        std::uint32_t res = dist(gen);
+        EXPECT_EQ(high_res_lut.interpolate(res), index.interpolate(res));
+    }
+}